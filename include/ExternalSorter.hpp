@@ -1,4 +1,5 @@
 #pragma once
+#include "SpillDir.hpp"
 #include "Table.hpp"
 
 /* =========================================================================
@@ -6,8 +7,11 @@
  *  – Gera runs de até 4 páginas (passo‑0)
  *  – Executa passes de merge 2‑way (cada pass usa 2 págs entrada + 1 saída)
  *  – Mantém, portanto, <= 4 páginas na RAM.
- *  – Devolve o caminho do CSV totalmente ordenado.
+ *  – Runs intermediários ficam em `spill`; E/S é contabilizada em `io`.
+ *  – Devolve o caminho do CSV totalmente ordenado (dentro de `spill`).
  * =========================================================================*/
 std::filesystem::path externalSort(const Table&      tbl,
                                    const std::string& colName,
-                                   const std::string& tag);
+                                   const std::string& tag,
+                                   const SpillDir&    spill,
+                                   IoTracker&         io);
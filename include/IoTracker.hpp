@@ -2,17 +2,19 @@
 #include <cstddef>
 
 /* ---------------------------------------------------------------------------
- *  Contador global de páginas lidas / gravadas.
+ *  Contador de páginas lidas / gravadas de UM job de junção.
  *  Cada vez que uma página de até 10 tuplas é transferida entre disco e RAM,
  *  incremente o contador correspondente (incRead / incWrite).
+ *  Não há estado global: cada junção possui sua própria instância, o que
+ *  permite executar vários jobs em paralelo sem misturar as métricas.
  * --------------------------------------------------------------------------*/
 struct IoTracker {
-    inline static std::size_t reads  = 0;   // páginas lidas
-    inline static std::size_t writes = 0;   // páginas gravadas
+    std::size_t reads  = 0;   // páginas lidas
+    std::size_t writes = 0;   // páginas gravadas
 
-    static void   reset()               { reads = writes = 0; }
-    static void   incRead()             { ++reads;  }
-    static void   incWrite()            { ++writes; }
-    static size_t pagesWritten()        { return writes; }
-    static size_t operations()          { return reads + writes; }
+    void   reset()                { reads = writes = 0; }
+    void   incRead()              { ++reads;  }
+    void   incWrite()             { ++writes; }
+    size_t pagesWritten()   const { return writes; }
+    size_t operations()     const { return reads + writes; }
 };
@@ -0,0 +1,121 @@
+#pragma once
+#include "SortMergeJoin.hpp"
+#include "ThreadPool.hpp"
+#include <condition_variable>
+#include <deque>
+#include <filesystem>
+#include <functional>
+#include <iosfwd>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+
+/* ---------------- descrição de um job de junção ----------------------------*/
+struct JoinJob {
+    std::filesystem::path relA;
+    std::filesystem::path relB;
+    std::string           colA;
+    std::string           colB;
+    std::filesystem::path outCsv;
+};
+
+/* ---------------- resultado de um job (sucesso => stats; falha => error) ---*/
+struct JobResult {
+    std::size_t              id = 0;
+    JoinJob                  job;
+    std::optional<JoinStats> stats;
+    std::string              error;
+};
+
+/* Converte uma linha "<relA> <relB> <colA> <colB> <saida>" em JoinJob.
+ * Linhas vazias ou iniciadas por '#' devolvem nullopt; formato inválido lança
+ * std::invalid_argument. */
+std::optional<JoinJob> parseJobLine(const std::string& line);
+
+/* ---------------- configuração do serviço ----------------------------------*/
+struct ServiceConfig {
+    std::size_t           threads     = 1;                 // tamanho do pool
+    std::size_t           memoryPages = PAGS_BUFFER_MAX;   // orçamento global
+    std::filesystem::path spillBase;                       // vazio = temp do SO
+};
+
+/* ========================================================================== *
+ *  Orçamento global de páginas em RAM, compartilhado pelos jobs.
+ *  `tryAcquire` nunca bloqueia; as páginas obtidas são devolvidas por um
+ *  `Lease` (RAII) quando o job termina.
+ * ========================================================================== */
+class MemoryBudget {
+public:
+    explicit MemoryBudget(std::size_t pages) : free_(pages) {}
+
+    bool tryAcquire(std::size_t pages);
+    void release(std::size_t pages);
+
+    /* Assume páginas já reservadas com tryAcquire e as devolve no destrutor */
+    class Lease {
+    public:
+        Lease(MemoryBudget& budget, std::size_t pages)
+            : budget_(budget), pages_(pages) {}
+        ~Lease() { budget_.release(pages_); }
+
+        Lease(const Lease&)            = delete;
+        Lease& operator=(const Lease&) = delete;
+    private:
+        MemoryBudget& budget_;
+        std::size_t   pages_;
+    };
+
+private:
+    std::size_t free_;
+    std::mutex  mtx_;
+};
+
+/* ========================================================================== *
+ *  Serviço local de junções concorrentes.
+ *  – Jobs submetidos entram numa fila de espera; o despachante só os entrega
+ *    ao ThreadPool depois de reservar PAGS_BUFFER_MAX páginas do orçamento,
+ *    logo no máximo memoryPages / PAGS_BUFFER_MAX junções ficam ativas e
+ *    nenhuma thread do pool fica bloqueada esperando memória.
+ *  – Cada job usa seu próprio SpillDir sob `spillBase` e seu próprio IoTracker.
+ *  – O resultado de cada job é entregue a `onResult` assim que ele termina
+ *    (chamadas serializadas, a partir das threads do pool).
+ *  – `serve` aceita jobs até EOF ou até a linha de comando "fim";
+ *    `serveFile` reabre FIFOs após EOF, mantendo o serviço ativo.
+ * ========================================================================== */
+class JoinService {
+public:
+    using ResultHandler = std::function<void(const JobResult&)>;
+
+    JoinService(const ServiceConfig& cfg, ResultHandler onResult);
+    ~JoinService();                          // aguarda jobs pendentes
+
+    JoinService(const JoinService&)            = delete;
+    JoinService& operator=(const JoinService&) = delete;
+
+    std::size_t submit(JoinJob job);         // thread-safe; devolve id do job
+    bool        serve(std::istream& jobs);   // true se recebeu "fim"
+    void        serveFile(const std::filesystem::path& jobs);
+    void        wait();                      // aguarda todos os jobs submetidos
+
+    std::size_t failures() const;
+
+private:
+    void dispatch();
+    void runJob(std::size_t id, const JoinJob& job);
+    void report(const JobResult& res);
+
+    ServiceConfig           cfg_;
+    ResultHandler           onResult_;
+    MemoryBudget            budget_;
+
+    mutable std::mutex      mtx_;            // protege os campos abaixo
+    std::condition_variable cvIdle_;         // fila vazia e nada em execução
+    std::deque<std::pair<std::size_t, JoinJob>> pending_;
+    std::size_t             nextId_   = 0;
+    std::size_t             inFlight_ = 0;
+    std::size_t             failures_ = 0;
+
+    std::mutex              reportMtx_;      // serializa onResult_
+    ThreadPool              pool_;           // último: destruído primeiro
+};
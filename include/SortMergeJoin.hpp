@@ -10,10 +10,13 @@ struct JoinStats {
 /* ============================================================================
  *  Sort‑Merge‑Join clássico, usando no máximo 4 páginas simultâneas:
  *      – 1 págs de A, 1 págs de B, 1 págs de saída, 1 págs cópia‑marcada.
- *  O resultado é escrito em `outCsv`.
+ *  O resultado é escrito em `outCsv`.  Os runs temporários vão para um
+ *  diretório exclusivo criado sob `spillBase` (vazio = temporário do sistema)
+ *  e removido ao final, de modo que várias junções podem rodar em paralelo.
  * ===========================================================================*/
 JoinStats sortMergeJoin(const Table&      A,
                         const Table&      B,
                         const std::string& colA,
                         const std::string& colB,
-                        const std::filesystem::path& outCsv);
+                        const std::filesystem::path& outCsv,
+                        const std::filesystem::path& spillBase = {});
@@ -0,0 +1,28 @@
+#pragma once
+#include <filesystem>
+#include <string>
+
+/* ========================================================================== *
+ *  Diretório temporário exclusivo de um job (runs do External Merge Sort).
+ *  – Criado sob `base` (ou no diretório temporário do sistema, se vazio);
+ *    pode apontar, por exemplo, para um tmpfs.
+ *  – O nome é único, de modo que vários processos/threads usando a mesma
+ *    base não sobrescrevem os runs uns dos outros.
+ *  – RAII: o diretório e todo o seu conteúdo são removidos no destrutor.
+ * ========================================================================== */
+class SpillDir {
+public:
+    explicit SpillDir(const std::filesystem::path& base = {});
+    ~SpillDir();
+
+    SpillDir(const SpillDir&)            = delete;
+    SpillDir& operator=(const SpillDir&) = delete;
+
+    const std::filesystem::path& path() const { return path_; }
+
+    /* caminho de um run: <dir>/tmp_<tag>_p<pass>_r<run>.csv */
+    std::filesystem::path runFile(const std::string& tag, int pass, int run) const;
+
+private:
+    std::filesystem::path path_;
+};
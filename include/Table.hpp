@@ -1,4 +1,5 @@
 #pragma once
+#include "IoTracker.hpp"
 #include "Page.hpp"
 #include <filesystem>
 #include <fstream>
@@ -17,16 +18,17 @@ public:
     const std::vector<std::string>& header()  const { return header_; }
     const std::filesystem::path&    csvPath() const { return path_;  }
 
-    /* --- Cursor sequencial de páginas --------------------------------------*/
+    /* --- Cursor sequencial de páginas (contabiliza E/S em `io`) -----------*/
     class PageCursor {
     public:
-        PageCursor(const Table& tbl, std::size_t colCnt);
+        PageCursor(const Table& tbl, std::size_t colCnt, IoTracker& io);
         bool next(Page& out);      // lê próxima página; devolve false em EOF
         void reset();              // reinicia ponteiro para início dos dados
     private:
         const Table&        tbl_;
         std::ifstream       fin_;
         std::size_t         colCnt_;
+        IoTracker&          io_;
     };
 
 private:
@@ -0,0 +1,39 @@
+#pragma once
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+/* ========================================================================== *
+ *  Pool fixo de threads com fila FIFO de tarefas.
+ *  – `enqueue` nunca bloqueia; `wait` aguarda a fila esvaziar e todas as
+ *    tarefas em andamento terminarem.
+ *  – O destrutor processa o que restar na fila antes de encerrar as threads.
+ *  – Tarefas não devem lançar exceções (capture-as dentro da tarefa).
+ * ========================================================================== */
+class ThreadPool {
+public:
+    explicit ThreadPool(std::size_t nThreads);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&)            = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    void        enqueue(std::function<void()> task);
+    void        wait();
+    std::size_t size() const { return workers_.size(); }
+
+private:
+    void workerLoop();
+
+    std::vector<std::thread>          workers_;
+    std::queue<std::function<void()>> tasks_;
+    std::mutex                        mtx_;
+    std::condition_variable           cvTask_;   // há tarefa ou pedido de parada
+    std::condition_variable           cvIdle_;   // fila vazia e nada em execução
+    std::size_t                       active_ = 0;
+    bool                              stop_   = false;
+};
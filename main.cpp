@@ -1,15 +1,103 @@
 #include "Table.hpp"
 #include "SortMergeJoin.hpp"
+#include "JoinService.hpp"
 #include <iostream>
+#include <optional>
+#include <string>
+#include <thread>
+
+namespace {
+void usage(const char* prog)
+{
+    std::cerr << "Uso:\n"
+              << "  " << prog
+              << " <tabelaA.csv> <tabelaB.csv> <colA> <colB> <saida.csv> [dirSpill]\n"
+              << "  " << prog
+              << " --servico <jobs.txt|fifo|-> [--threads N] [--memoria PAGS] [--spill DIR]\n"
+              << "Exemplo:\n"
+              << "  " << prog
+              << " data/vinho.csv data/pais.csv pais_producao_id pais_id  resultado_vinho_pais.csv\n";
+}
+
+constexpr std::size_t THREADS_MAX = 256;       // limite de --threads
+
+/* Converte argumento numérico; devolve nullopt se não for inteiro decimal */
+std::optional<std::size_t> parseCount(const std::string& arg)
+{
+    if (arg.empty() || arg.find_first_not_of("0123456789") != std::string::npos)
+        return std::nullopt;
+    try {
+        return static_cast<std::size_t>(std::stoull(arg));
+    } catch (const std::out_of_range&) {
+        return std::nullopt;
+    }
+}
+
+/* Imprime o resultado de um job assim que ele termina */
+void printResult(const JobResult& res)
+{
+    if (res.stats) {
+        std::cout << "[job " << res.id << "] " << res.job.outCsv.string()
+                  << "  #I/Os=" << res.stats->ioOps
+                  << "  #Páginas=" << res.stats->pagesOut
+                  << "  #Tuplas=" << res.stats->tuplesOut << std::endl;
+    } else {
+        std::cout << "[job " << res.id << "] Erro: " << res.error << std::endl;
+    }
+}
+
+/* Modo serviço: lê jobs (um por linha) e os executa em um pool compartilhado */
+int runService(int argc, char* argv[])
+{
+    if (argc < 3) { usage(argv[0]); return 1; }
+
+    const std::string jobsArg = argv[2];
+    const unsigned    hw      = std::thread::hardware_concurrency();
+
+    ServiceConfig              cfg;
+    std::optional<std::size_t> threads, memoria;
+
+    for (int i = 3; i < argc; ++i) {
+        const std::string opt = argv[i];
+        if (i + 1 >= argc) { usage(argv[0]); return 1; }
+        const std::string val = argv[++i];
+
+        if (opt == "--threads" || opt == "--memoria") {
+            auto n = parseCount(val);
+            if (!n) { usage(argv[0]); return 1; }
+            (opt == "--threads" ? threads : memoria) = *n;
+        }
+        else if (opt == "--spill") cfg.spillBase = val;
+        else { usage(argv[0]); return 1; }
+    }
+
+    cfg.threads = threads.value_or(hw ? hw : 1);
+    if (cfg.threads == 0 || cfg.threads > THREADS_MAX) {
+        std::cerr << "Erro: --threads deve estar entre 1 e " << THREADS_MAX << "\n";
+        return 1;
+    }
+    cfg.memoryPages = memoria.value_or(cfg.threads * PAGS_BUFFER_MAX);
+
+    JoinService svc(cfg, printResult);
+    if (jobsArg == "-") svc.serve(std::cin);
+    else                svc.serveFile(jobsArg);
+    svc.wait();
+
+    return svc.failures() ? 2 : 0;
+}
+} // namespace
 
 int main(int argc, char* argv[]) {
-    if (argc != 6) {
-        std::cerr << "Uso: " 
-                  << argv[0] 
-                  << " <tabelaA.csv> <tabelaB.csv> <colA> <colB> <saida.csv>\n"
-                  << "Exemplo:\n"
-                  << "  " << argv[0]
-                  << " data/vinho.csv data/pais.csv pais_producao_id pais_id  resultado_vinho_pais.csv\n";
+    try {
+        if (argc >= 2 && std::string(argv[1]) == "--servico")
+            return runService(argc, argv);
+    } catch (const std::exception& e) {
+        std::cerr << "Erro: " << e.what() << "\n";
+        return 2;
+    }
+
+    if (argc != 6 && argc != 7) {
+        usage(argv[0]);
         return 1;
     }
 
@@ -23,11 +111,12 @@ int main(int argc, char* argv[]) {
             A, B,
             argv[3],  // nome da coluna na tabela A
             argv[4],  // nome da coluna na tabela B
-            argv[5]   // arquivo de saída
+            argv[5],  // arquivo de saída
+            argc == 7 ? argv[6] : ""   // base do diretório de spill
         );
 
         // 3) imprime métricas
-        std::cout 
+        std::cout
             << "#I/Os       : " << stats.ioOps     << "\n"
             << "#Páginas out: " << stats.pagesOut  << "\n"
             << "#Tuplas out : " << stats.tuplesOut << "\n";
@@ -1,5 +1,4 @@
 #include "ExternalSorter.hpp"
-#include "IoTracker.hpp"
 #include <algorithm>
 #include <cstdio>
 #include <deque>
@@ -17,7 +16,7 @@ void splitLine(const std::string& line, std::vector<std::string>& out)
         out.emplace_back(std::move(tok));
 }
 
-bool readPage(std::ifstream& fin, Page& page, std::size_t colCnt,
+bool readPage(std::ifstream& fin, Page& page, std::size_t colCnt, IoTracker& io,
               std::streampos* beginOut = nullptr)
 {
     page.clear();
@@ -32,11 +31,11 @@ bool readPage(std::ifstream& fin, Page& page, std::size_t colCnt,
         page.emplace(std::move(t));
         ++i;
     }
-    if (!page.empty()) { IoTracker::incRead(); return true; }
+    if (!page.empty()) { io.incRead(); return true; }
     return false;
 }
 
-void writePage(std::ofstream& fout, const Page& page)
+void writePage(std::ofstream& fout, const Page& page, IoTracker& io)
 {
     for (const auto& t : page.tuples()) {
         for (std::size_t i = 0; i < t.cols.size(); ++i) {
@@ -45,21 +44,16 @@ void writePage(std::ofstream& fout, const Page& page)
         }
         fout << '\n';
     }
-    IoTracker::incWrite();
-}
-
-std::filesystem::path tmpName(const std::string& tag, int pass, int run)
-{
-    return std::filesystem::path{"tmp_" + tag + "_p" + std::to_string(pass) +
-                                         "_r" + std::to_string(run) + ".csv"};
+    io.incWrite();
 }
 } // anonymous namespace
 
 /* ------------------- PASSO 0 – geração dos runs -------------------------- */
 static std::deque<std::filesystem::path>
-pass0(const Table& tbl, std::size_t keyIdx, const std::string& tag)
+pass0(const Table& tbl, std::size_t keyIdx, const std::string& tag,
+      const SpillDir& spill, IoTracker& io)
 {
-    Table::PageCursor cur(tbl, tbl.header().size());
+    Table::PageCursor cur(tbl, tbl.header().size(), io);
 
     std::deque<std::filesystem::path> runs;
     std::vector<Tuple> mem;
@@ -74,7 +68,7 @@ pass0(const Table& tbl, std::size_t keyIdx, const std::string& tag)
                       [&](const Tuple& a, const Tuple& b)
                       { return a.cols[keyIdx] < b.cols[keyIdx]; });
 
-            auto name = tmpName(tag, 0, runId++);
+            auto name = spill.runFile(tag, 0, runId++);
             std::ofstream fout(name);
 
             /* cabeçalho */
@@ -84,26 +78,27 @@ pass0(const Table& tbl, std::size_t keyIdx, const std::string& tag)
                 fout << hdr[i];
             }
             fout << '\n';
-            IoTracker::incWrite();          // cabeçalho conta como 1 página
+            io.incWrite();          // cabeçalho conta como 1 página
 
             Page out;
             for (auto& tup : mem) {
-                if (out.full()) { writePage(fout, out); out.clear(); }
+                if (out.full()) { writePage(fout, out, io); out.clear(); }
                 out.emplace(std::move(tup));
             }
-            if (!out.empty()) writePage(fout, out);
+            if (!out.empty()) writePage(fout, out, io);
 
             runs.push_back(name);
             mem.clear();
         }
     }
 
-    if (!mem.empty()) {
+    /* relação sem tuplas: gera um run só com cabeçalho (nunca devolve 0 runs) */
+    if (!mem.empty() || runs.empty()) {
         std::sort(mem.begin(), mem.end(),
                   [&](const Tuple& a, const Tuple& b)
                   { return a.cols[keyIdx] < b.cols[keyIdx]; });
 
-        auto name = tmpName(tag, 0, runId++);
+        auto name = spill.runFile(tag, 0, runId++);
         std::ofstream fout(name);
 
         const auto& hdr = tbl.header();
@@ -112,14 +107,14 @@ pass0(const Table& tbl, std::size_t keyIdx, const std::string& tag)
             fout << hdr[i];
         }
         fout << '\n';
-        IoTracker::incWrite();
+        io.incWrite();
 
         Page out;
         for (auto& tup : mem) {
-            if (out.full()) { writePage(fout, out); out.clear(); }
+            if (out.full()) { writePage(fout, out, io); out.clear(); }
             out.emplace(std::move(tup));
         }
-        if (!out.empty()) writePage(fout, out);
+        if (!out.empty()) writePage(fout, out, io);
 
         runs.push_back(name);
     }
@@ -134,21 +129,23 @@ mergeTwo(const std::filesystem::path& A,
          const std::vector<std::string>& header,
          const std::string& tag,
          int passNo,
-         int outId)
+         int outId,
+         const SpillDir& spill,
+         IoTracker& io)
 {
     std::ifstream fa(A), fb(B);
     std::string dummy;
-    std::getline(fa, dummy);  IoTracker::incRead();    // cabeçalhos
-    std::getline(fb, dummy);  IoTracker::incRead();
+    std::getline(fa, dummy);  io.incRead();    // cabeçalhos
+    std::getline(fb, dummy);  io.incRead();
 
     Page pA, pB, out;
     std::streampos posA = 0, posB = 0;
-    readPage(fa, pA, header.size(), &posA);
-    readPage(fb, pB, header.size(), &posB);
+    readPage(fa, pA, header.size(), io, &posA);
+    readPage(fb, pB, header.size(), io, &posB);
 
     std::size_t ia = 0, ib = 0;
 
-    auto outName = tmpName(tag, passNo, outId);
+    auto outName = spill.runFile(tag, passNo, outId);
     std::ofstream fout(outName);
 
     /* escreve cabeçalho */
@@ -157,37 +154,37 @@ mergeTwo(const std::filesystem::path& A,
         fout << header[i];
     }
     fout << '\n';
-    IoTracker::incWrite();    // cabeçalho = 1 página
+    io.incWrite();    // cabeçalho = 1 página
 
     while (!pA.empty() && !pB.empty()) {
         const auto& ta = pA.tuples()[ia];
         const auto& tb = pB.tuples()[ib];
 
         if (ta.cols[keyIdx] <= tb.cols[keyIdx]) {
-            if (out.full()) { writePage(fout, out); out.clear(); }
+            if (out.full()) { writePage(fout, out, io); out.clear(); }
             out.emplace(ta);               // cópia barata (pequenas strings)
             ++ia;
-            if (ia == pA.tuples().size()) { readPage(fa, pA, header.size(), &posA); ia = 0; }
+            if (ia == pA.tuples().size()) { readPage(fa, pA, header.size(), io, &posA); ia = 0; }
         } else {
-            if (out.full()) { writePage(fout, out); out.clear(); }
+            if (out.full()) { writePage(fout, out, io); out.clear(); }
             out.emplace(tb);
             ++ib;
-            if (ib == pB.tuples().size()) { readPage(fb, pB, header.size(), &posB); ib = 0; }
+            if (ib == pB.tuples().size()) { readPage(fb, pB, header.size(), io, &posB); ib = 0; }
         }
     }
     /* descarrega resto */
     auto flushRest = [&](Page& pg, std::size_t& idx, std::ifstream& fin,
                          std::streampos& pos){
         while (!pg.empty()) {
-            if (idx == pg.tuples().size()) { readPage(fin, pg, header.size(), &pos); idx = 0; continue; }
-            if (out.full()) { writePage(fout, out); out.clear(); }
+            if (idx == pg.tuples().size()) { readPage(fin, pg, header.size(), io, &pos); idx = 0; continue; }
+            if (out.full()) { writePage(fout, out, io); out.clear(); }
             out.emplace(pg.tuples()[idx++]);
         }
     };
     flushRest(pA, ia, fa, posA);
     flushRest(pB, ib, fb, posB);
 
-    if (!out.empty()) writePage(fout, out);
+    if (!out.empty()) writePage(fout, out, io);
     return outName;
 }
 
@@ -197,7 +194,9 @@ mergePass(std::deque<std::filesystem::path>& runs,
           std::size_t keyIdx,
           const std::vector<std::string>& header,
           const std::string& tag,
-          int passNo)
+          int passNo,
+          const SpillDir& spill,
+          IoTracker& io)
 {
     std::deque<std::filesystem::path> out;
     int id = 0;
@@ -208,7 +207,7 @@ mergePass(std::deque<std::filesystem::path>& runs,
             break;
         }
         auto B = runs.front(); runs.pop_front();
-        out.push_back(mergeTwo(A, B, keyIdx, header, tag, passNo, id++));
+        out.push_back(mergeTwo(A, B, keyIdx, header, tag, passNo, id++, spill, io));
         std::remove(A.string().c_str());
         std::remove(B.string().c_str());
     }
@@ -218,13 +217,15 @@ mergePass(std::deque<std::filesystem::path>& runs,
 /* ------------------------- driver externo -------------------------------- */
 std::filesystem::path externalSort(const Table& tbl,
                                    const std::string& colName,
-                                   const std::string& tag)
+                                   const std::string& tag,
+                                   const SpillDir&    spill,
+                                   IoTracker&         io)
 {
     const std::size_t keyIdx = tbl.colIndex(colName);
 
-    auto runs = pass0(tbl, keyIdx, tag);
+    auto runs = pass0(tbl, keyIdx, tag, spill, io);
     int passNo = 1;
     while (runs.size() > 1)
-        runs = mergePass(runs, keyIdx, tbl.header(), tag, passNo++);
+        runs = mergePass(runs, keyIdx, tbl.header(), tag, passNo++, spill, io);
     return runs.front();           // arquivo final ordenado
 }
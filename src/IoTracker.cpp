@@ -1,2 +1,2 @@
 #include "IoTracker.hpp"
-/* Members são inline — nada a definir aqui. */
+/* Membros são inline e por instância — nada a definir aqui. */
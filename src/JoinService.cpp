@@ -0,0 +1,179 @@
+#include "JoinService.hpp"
+#include <fstream>
+#include <istream>
+#include <sstream>
+#include <stdexcept>
+
+namespace {
+/* linha que encerra o serviço (após concluir os jobs já aceitos) */
+constexpr const char* COMANDO_FIM = "fim";
+
+/* --------------- utilitário: valida o orçamento antes de criar o pool ----- */
+std::size_t checkedBudget(const ServiceConfig& cfg)
+{
+    if (cfg.memoryPages < PAGS_BUFFER_MAX)
+        throw std::invalid_argument("Orçamento de memória menor que " +
+                                    std::to_string(PAGS_BUFFER_MAX) +
+                                    " páginas (mínimo de um job)");
+    return cfg.memoryPages;
+}
+} // anonymous namespace
+
+/* ----------------------------- parseJobLine ------------------------------ */
+std::optional<JoinJob> parseJobLine(const std::string& line)
+{
+    std::istringstream ss(line);
+    std::string first;
+    if (!(ss >> first) || first[0] == '#') return std::nullopt;
+
+    JoinJob job;
+    std::string relB, outCsv;
+    job.relA = first;
+    if (!(ss >> relB >> job.colA >> job.colB >> outCsv))
+        throw std::invalid_argument("Job incompleto: \"" + line + "\"");
+
+    std::string extra;
+    if (ss >> extra)
+        throw std::invalid_argument("Campos excedentes no job: \"" + line + "\"");
+
+    job.relB   = relB;
+    job.outCsv = outCsv;
+    return job;
+}
+
+/* ----------------------------- MemoryBudget ------------------------------ */
+bool MemoryBudget::tryAcquire(std::size_t pages)
+{
+    std::lock_guard<std::mutex> lk(mtx_);
+    if (free_ < pages) return false;
+    free_ -= pages;
+    return true;
+}
+
+void MemoryBudget::release(std::size_t pages)
+{
+    std::lock_guard<std::mutex> lk(mtx_);
+    free_ += pages;
+}
+
+/* ----------------------------- JoinService ------------------------------- */
+JoinService::JoinService(const ServiceConfig& cfg, ResultHandler onResult)
+    : cfg_(cfg), onResult_(std::move(onResult)), budget_(checkedBudget(cfg)),
+      pool_(cfg.threads)
+{
+}
+
+JoinService::~JoinService()
+{
+    wait();
+}
+
+std::size_t JoinService::submit(JoinJob job)
+{
+    std::size_t id;
+    {
+        std::lock_guard<std::mutex> lk(mtx_);
+        id = nextId_++;
+        pending_.emplace_back(id, std::move(job));
+    }
+    dispatch();
+    return id;
+}
+
+bool JoinService::serve(std::istream& jobs)
+{
+    std::string line;
+    while (std::getline(jobs, line)) {
+        std::istringstream ss(line);
+        std::string cmd, extra;
+        if (ss >> cmd && cmd == COMANDO_FIM && !(ss >> extra)) return true;
+
+        try {
+            if (auto job = parseJobLine(line)) submit(std::move(*job));
+        } catch (const std::exception& e) {
+            JobResult res;
+            {
+                std::lock_guard<std::mutex> lk(mtx_);
+                res.id = nextId_++;
+            }
+            res.error = e.what();
+            report(res);
+        }
+    }
+    return false;
+}
+
+void JoinService::serveFile(const std::filesystem::path& jobs)
+{
+    /* Um FIFO chega a EOF sempre que o último escritor fecha; reabri-lo
+     * bloqueia até o próximo escritor, mantendo o serviço ativo até "fim". */
+    for (;;) {
+        std::ifstream fin(jobs);
+        if (!fin) throw std::runtime_error("Não foi possível abrir " + jobs.string());
+        if (serve(fin) || !std::filesystem::is_fifo(jobs)) break;
+    }
+}
+
+void JoinService::wait()
+{
+    std::unique_lock<std::mutex> lk(mtx_);
+    cvIdle_.wait(lk, [this] { return pending_.empty() && inFlight_ == 0; });
+}
+
+std::size_t JoinService::failures() const
+{
+    std::lock_guard<std::mutex> lk(mtx_);
+    return failures_;
+}
+
+void JoinService::dispatch()
+{
+    std::lock_guard<std::mutex> lk(mtx_);
+    while (!pending_.empty() && budget_.tryAcquire(PAGS_BUFFER_MAX)) {
+        auto [id, job] = std::move(pending_.front());
+        pending_.pop_front();
+        ++inFlight_;
+        pool_.enqueue([this, id = id, job = std::move(job)] { runJob(id, job); });
+    }
+}
+
+void JoinService::runJob(std::size_t id, const JoinJob& job)
+{
+    JobResult res;
+    res.id  = id;
+    res.job = job;
+    {
+        MemoryBudget::Lease lease(budget_, PAGS_BUFFER_MAX);   // reservado em dispatch()
+        try {
+            Table A(job.relA);
+            Table B(job.relB);
+            res.stats = sortMergeJoin(A, B, job.colA, job.colB, job.outCsv,
+                                      cfg_.spillBase);
+        } catch (const std::exception& e) {
+            res.error = e.what();
+        } catch (...) {
+            res.error = "exceção desconhecida";
+        }
+    }
+    dispatch();                         // páginas liberadas: próximo da fila
+    report(res);
+
+    std::lock_guard<std::mutex> lk(mtx_);
+    --inFlight_;
+    if (pending_.empty() && inFlight_ == 0) cvIdle_.notify_all();
+}
+
+void JoinService::report(const JobResult& res)
+{
+    if (!res.stats) {
+        std::lock_guard<std::mutex> lk(mtx_);
+        ++failures_;
+    }
+
+    std::lock_guard<std::mutex> lk(reportMtx_);
+    try {
+        if (onResult_) onResult_(res);
+    } catch (...) {
+        /* falha ao reportar não pode derrubar a thread do pool */
+    }
+}
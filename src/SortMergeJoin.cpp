@@ -1,5 +1,4 @@
 #include "SortMergeJoin.hpp"
-#include "IoTracker.hpp"
 #include <fstream>
 #include <sstream>
 #include <stdexcept>
@@ -8,7 +7,8 @@ namespace {
 // Escreve o cabeçalho com prefixos A. e B.
 void writeHeader(std::ofstream& fout,
                  const std::vector<std::string>& hA,
-                 const std::vector<std::string>& hB)
+                 const std::vector<std::string>& hB,
+                 IoTracker& io)
 {
     for (std::size_t i = 0; i < hA.size(); ++i) {
         if (i) fout << CSV_SEP;
@@ -18,11 +18,11 @@ void writeHeader(std::ofstream& fout,
         fout << CSV_SEP << "B." << hB[i];
     }
     fout << '\n';
-    IoTracker::incWrite();  // conta como 1 página escrita
+    io.incWrite();  // conta como 1 página escrita
 }
 
 // Reutiliza o leitor de páginas, atualizando o contador de I/Os.
-bool readPage(std::ifstream& fin, Page& page, std::size_t colCnt,
+bool readPage(std::ifstream& fin, Page& page, std::size_t colCnt, IoTracker& io,
               std::streampos* beginOut = nullptr)
 {
     page.clear();
@@ -40,20 +40,24 @@ bool readPage(std::ifstream& fin, Page& page, std::size_t colCnt,
         page.emplace(std::move(t));
         ++i;
     }
-    if (!page.empty()) { IoTracker::incRead(); return true; }
+    if (!page.empty()) { io.incRead(); return true; }
     return false;
 }
 } // namespace
 
 JoinStats sortMergeJoin(const Table& A, const Table& B,
                         const std::string& colA, const std::string& colB,
-                        const std::filesystem::path& outCsv)
+                        const std::filesystem::path& outCsv,
+                        const std::filesystem::path& spillBase)
 {
-    IoTracker::reset();
+    // Estado exclusivo deste job: contador de E/S e diretório de runs.
+    // `spill` é declarado antes dos streams, logo é destruído depois deles.
+    IoTracker io;
+    SpillDir  spill(spillBase);
 
     // 1. Ordena as duas relações externamente
-    const auto fAs = externalSort(A, colA, "A");
-    const auto fBs = externalSort(B, colB, "B");
+    const auto fAs = externalSort(A, colA, "A", spill, io);
+    const auto fBs = externalSort(B, colB, "B", spill, io);
 
     // 2. Abre arquivos ordenados
     std::ifstream fa(fAs), fb(fBs);
@@ -62,8 +66,8 @@ JoinStats sortMergeJoin(const Table& A, const Table& B,
 
     // Pula cabeçalhos
     std::string dummy;
-    std::getline(fa, dummy); IoTracker::incRead();
-    std::getline(fb, dummy); IoTracker::incRead();
+    std::getline(fa, dummy); io.incRead();
+    std::getline(fb, dummy); io.incRead();
 
     const auto& hA  = A.header();
     const auto& hB  = B.header();
@@ -73,11 +77,11 @@ JoinStats sortMergeJoin(const Table& A, const Table& B,
     Page pA, pB, pBmark, out;
     std::size_t ia = 0, ib = 0, ibMark = 0;
     std::streampos posA = 0, posB = 0, posBmark = 0;
-    readPage(fa, pA, hA.size(), &posA);
-    readPage(fb, pB, hB.size(), &posB);
+    readPage(fa, pA, hA.size(), io, &posA);
+    readPage(fb, pB, hB.size(), io, &posB);
 
     std::ofstream fout(outCsv);
-    writeHeader(fout, hA, hB);
+    writeHeader(fout, hA, hB, io);
 
     std::size_t tuplesOut = 0;
 
@@ -87,7 +91,7 @@ JoinStats sortMergeJoin(const Table& A, const Table& B,
         while (!pA.empty() && !pB.empty() && pA.tuples()[ia].cols[keyA] < pB.tuples()[ib].cols[keyB]) {
             ++ia;
             if (ia == pA.tuples().size()) {
-                if (!readPage(fa, pA, hA.size(), &posA)) { pA.clear(); break; }
+                if (!readPage(fa, pA, hA.size(), io, &posA)) { pA.clear(); break; }
                 ia = 0;
             }
         }
@@ -95,7 +99,7 @@ JoinStats sortMergeJoin(const Table& A, const Table& B,
         while (!pA.empty() && !pB.empty() && pA.tuples()[ia].cols[keyA] > pB.tuples()[ib].cols[keyB]) {
             ++ib;
             if (ib == pB.tuples().size()) {
-                if (!readPage(fb, pB, hB.size(), &posB)) { pB.clear(); break; }
+                if (!readPage(fb, pB, hB.size(), io, &posB)) { pB.clear(); break; }
                 ib = 0;
             }
         }
@@ -124,7 +128,7 @@ JoinStats sortMergeJoin(const Table& A, const Table& B,
                         }
                         fout << '\n';
                     }
-                    IoTracker::incWrite();
+                    io.incWrite();
                     out.clear();
                 }
 
@@ -137,7 +141,7 @@ JoinStats sortMergeJoin(const Table& A, const Table& B,
 
                 ++ib;
                 if (ib == pB.tuples().size()) {
-                    if (!readPage(fb, pB, hB.size(), &posB)) break;
+                    if (!readPage(fb, pB, hB.size(), io, &posB)) break;
                     ib = 0;
                 }
             }
@@ -145,7 +149,7 @@ JoinStats sortMergeJoin(const Table& A, const Table& B,
             // Avança A
             ++ia;
             if (ia == pA.tuples().size()) {
-                if (!readPage(fa, pA, hA.size(), &posA)) break;
+                if (!readPage(fa, pA, hA.size(), io, &posA)) break;
                 ia = 0;
             }
         }
@@ -156,7 +160,7 @@ JoinStats sortMergeJoin(const Table& A, const Table& B,
         do {
             ++ib;
             if (ib == pB.tuples().size()) {
-                if (!readPage(fb, pB, hB.size(), &posB)) { pB.clear(); break; }
+                if (!readPage(fb, pB, hB.size(), io, &posB)) { pB.clear(); break; }
                 ib = 0;
             }
         } while (!pB.empty() && pB.tuples()[ib].cols[keyB] == currKey);
@@ -171,12 +175,12 @@ JoinStats sortMergeJoin(const Table& A, const Table& B,
             }
             fout << '\n';
         }
-        IoTracker::incWrite();
+        io.incWrite();
     }
 
     JoinStats st;
-    st.ioOps     = IoTracker::operations();
-    st.pagesOut  = IoTracker::pagesWritten();
+    st.ioOps     = io.operations();
+    st.pagesOut  = io.pagesWritten();
     st.tuplesOut = tuplesOut;
     return st;
 }
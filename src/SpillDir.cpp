@@ -0,0 +1,52 @@
+#include "SpillDir.hpp"
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <system_error>
+
+namespace {
+/* --------------- utilitário: sufixo único para o diretório --------------- */
+std::string uniqueSuffix()
+{
+    static std::atomic<unsigned long> counter{0};
+    static const unsigned long seed = std::random_device{}();
+
+    std::ostringstream ss;
+    ss << std::hex << seed << '_'
+       << std::chrono::steady_clock::now().time_since_epoch().count() << '_'
+       << counter++;
+    return ss.str();
+}
+} // anonymous namespace
+
+/* ----------------------------- SpillDir ---------------------------------- */
+SpillDir::SpillDir(const std::filesystem::path& base)
+{
+    const auto root = base.empty() ? std::filesystem::temp_directory_path() : base;
+    std::filesystem::create_directories(root);
+
+    /* create_directory devolve false se o nome já existe: tenta outro */
+    for (int attempt = 0; attempt < 16; ++attempt) {
+        auto cand = root / ("smj_spill_" + uniqueSuffix());
+        if (std::filesystem::create_directory(cand)) {
+            path_ = std::move(cand);
+            return;
+        }
+    }
+    throw std::runtime_error("Não foi possível criar diretório de spill em " +
+                             root.string());
+}
+
+SpillDir::~SpillDir()
+{
+    std::error_code ec;                 // destrutor não pode lançar
+    std::filesystem::remove_all(path_, ec);
+}
+
+std::filesystem::path SpillDir::runFile(const std::string& tag, int pass, int run) const
+{
+    return path_ / ("tmp_" + tag + "_p" + std::to_string(pass) +
+                            "_r" + std::to_string(run) + ".csv");
+}
@@ -1,5 +1,4 @@
 #include "Table.hpp"
-#include "IoTracker.hpp"
 #include <sstream>
 #include <stdexcept>
 
@@ -15,7 +14,7 @@ void splitLine(const std::string& line, std::vector<std::string>& out)
 }
 
 /* --------------- utilitário: lê 1 página do arquivo ---------------------- */
-bool readPage(std::ifstream& fin, Page& page, std::size_t colCnt,
+bool readPage(std::ifstream& fin, Page& page, std::size_t colCnt, IoTracker& io,
               std::streampos* pageBeginOut = nullptr)
 {
     page.clear();
@@ -30,7 +29,7 @@ bool readPage(std::ifstream& fin, Page& page, std::size_t colCnt,
         page.emplace(std::move(t));
         ++i;
     }
-    if (!page.empty()) { IoTracker::incRead(); return true; }
+    if (!page.empty()) { io.incRead(); return true; }
     return false;
 }
 } // anonymous namespace
@@ -56,17 +55,17 @@ std::size_t Table::colIndex(const std::string& name) const
 }
 
 /* ------------------------ PageCursor ------------------------------------- */
-Table::PageCursor::PageCursor(const Table& tbl, std::size_t colCnt)
-    : tbl_(tbl), colCnt_(colCnt), fin_(tbl.csvPath())
+Table::PageCursor::PageCursor(const Table& tbl, std::size_t colCnt, IoTracker& io)
+    : tbl_(tbl), fin_(tbl.csvPath()), colCnt_(colCnt), io_(io)
 {
     std::string dummy;
     std::getline(fin_, dummy);          // cabeçalho
-    IoTracker::incRead();
+    io_.incRead();
 }
 
 bool Table::PageCursor::next(Page& out)
 {
-    return readPage(fin_, out, colCnt_);
+    return readPage(fin_, out, colCnt_, io_);
 }
 
 void Table::PageCursor::reset()
@@ -75,5 +74,5 @@ void Table::PageCursor::reset()
     fin_.seekg(0);
     std::string dummy;
     std::getline(fin_, dummy);
-    IoTracker::incRead();
+    io_.incRead();
 }
@@ -0,0 +1,73 @@
+#include "ThreadPool.hpp"
+#include <stdexcept>
+
+/* ----------------------------- ThreadPool -------------------------------- */
+ThreadPool::ThreadPool(std::size_t nThreads)
+{
+    if (nThreads == 0)
+        throw std::invalid_argument("ThreadPool precisa de ao menos 1 thread");
+
+    try {
+        workers_.reserve(nThreads);
+        for (std::size_t i = 0; i < nThreads; ++i)
+            workers_.emplace_back([this] { workerLoop(); });
+    } catch (...) {
+        /* o destrutor não roda: encerra as threads já criadas antes de
+         * relançar, senão ~vector<thread> chamaria std::terminate */
+        {
+            std::lock_guard<std::mutex> lk(mtx_);
+            stop_ = true;
+        }
+        cvTask_.notify_all();
+        for (auto& w : workers_) w.join();
+        throw;
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lk(mtx_);
+        stop_ = true;
+    }
+    cvTask_.notify_all();
+    for (auto& w : workers_) w.join();
+}
+
+void ThreadPool::enqueue(std::function<void()> task)
+{
+    {
+        std::lock_guard<std::mutex> lk(mtx_);
+        tasks_.push(std::move(task));
+    }
+    cvTask_.notify_one();
+}
+
+void ThreadPool::wait()
+{
+    std::unique_lock<std::mutex> lk(mtx_);
+    cvIdle_.wait(lk, [this] { return tasks_.empty() && active_ == 0; });
+}
+
+void ThreadPool::workerLoop()
+{
+    for (;;) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lk(mtx_);
+            cvTask_.wait(lk, [this] { return stop_ || !tasks_.empty(); });
+            if (tasks_.empty()) return;         // stop_ e nada pendente
+            task = std::move(tasks_.front());
+            tasks_.pop();
+            ++active_;
+        }
+
+        task();
+
+        {
+            std::lock_guard<std::mutex> lk(mtx_);
+            --active_;
+            if (tasks_.empty() && active_ == 0) cvIdle_.notify_all();
+        }
+    }
+}